@@ -440,18 +440,84 @@ void visualizarPilha(const PilhaReserva *p) {
 #include <stdlib.h>
 #include <string.h>
 #include <locale.h>
+#include <stdint.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#ifdef __GLIBC__
+#include <malloc.h> // malloc_usable_size(): bytes que o alocador realmente reservou
+#endif
 
 // --- Constantes ---
 #define TAM_NOME_SALA 50
 #define TAM_NOME_PISTA 50
 #define TAM_NOME_SUSPEITO 50
 #define TAM_TABELA_HASH 7 // Tamanho primo para a tabela hash
+#define CHD_CHAVES_POR_BALDE 4 // Média de chaves por balde na construção do hash perfeito
+#define CHD_MAX_DESLOCAMENTOS (1u << 20) // Sementes testadas por balde antes de aumentar a tabela
+#define CHD_CARGA_PERCENTUAL 95 // Ocupação das m posições (n / m) na construção
+#define VERSAO_HASH_CONGELADA 4u
+#define REPETICOES_MEDICAO 200000 // Buscas máximas por medição de desempenho
+#define TEMPO_MAX_MEDICAO 0.25    // Segundos máximos por medição (a busca encadeada é O(n / 7))
+#define TAM_BLOCO_RELATORIO (256 * 1024) // Bytes por bloco do buffer do relatório
+#define NUM_BLOCOS_RELATORIO 4           // Blocos descarregados juntos (um writev)
+#define VERSAO_RELATORIO_BINARIO 2
+#define REGISTRO_BINARIO_PISTA 1           // pista
+#define REGISTRO_BINARIO_ASSOCIACAO 2      // pista, suspeito
+#define REGISTRO_BINARIO_CONCLUSAO 3       // culpado, evidências (uint32)
+#define REGISTRO_BINARIO_SEM_ASSOCIACAO 4  // pista (associação não encontrada na Hash)
+// Compile com -DMODO_COMPACTO para guardar salas, pistas, a Hash e as entradas da Hash
+// congelada em arenas com índices de 32 bits e um pool de nomes, em vez de nós com char[50]
+#define INDICE_NULO UINT32_MAX        // "Ponteiro nulo" dos índices de 32 bits
+#define SALA_TEM_PISTA 0x80000000u    // Bit de temPista embutido no campo pista da sala compacta
+#define BITS_POSICAO_NO 12            // Índice de nó = bloco << 12 | posição no bloco
+#define NOS_POR_BLOCO (1u << BITS_POSICAO_NO) // Nós por bloco (máximo) nas arenas de salas e pistas
+#define NOS_PRIMEIRO_BLOCO 16u        // Os blocos de nós dobram de 16 até NOS_POR_BLOCO
+#define LIMITE_POOL_NOMES 0x7FFFFFFFu // Deslocamentos do pool de nomes usam 31 bits
+#define BITS_POSICAO_NOME 16          // Deslocamento = bloco << 16 | posição no bloco
+#define TAM_BLOCO_NOMES (1u << BITS_POSICAO_NOME) // Tamanho máximo de um bloco do pool
+#define TAM_PRIMEIRO_BLOCO_NOMES 256u // Os blocos dobram de 256 bytes até TAM_BLOCO_NOMES
 
 // ============================================================================
 // --- Estruturas de Dados ---
 // ============================================================================
 
+#ifdef MODO_COMPACTO
+// 0. Pool de Nomes do Modo Compacto
+// Cada nome é guardado uma única vez e referenciado pelo deslocamento (31 bits).
+// Os blocos nunca mudam de lugar: um ponteiro para um nome vale até o pool ser liberado.
+typedef uint32_t IndiceNo;
+
+typedef struct {
+    char **blocos;             // Bloco k tem min(256 << k, TAM_BLOCO_NOMES) bytes
+    uint32_t totalBlocos;
+    uint32_t capacidadeBlocos;
+    uint32_t usadoBloco;       // Bytes ocupados no último bloco
+    size_t bytesNomes;         // Bytes de todos os nomes (com o '\0')
+    uint32_t *indice;          // Endereçamento aberto: deslocamento + 1 (0 = vazio)
+    uint32_t capacidadeIndice; // Potência de 2
+    uint32_t totalNomes;
+} PoolNomes;
+
+// Arena de nós (salas ou pistas) em blocos que nunca mudam de lugar: um Sala* continua
+// válido enquanto a arena existir, e os filhos se ligam por índices de 32 bits.
+typedef struct {
+    char **blocos;             // Bloco k tem min(16 << k, NOS_POR_BLOCO) nós
+    uint32_t *porEndereco;     // Blocos em ordem crescente de endereço (ponteiro -> índice)
+    uint32_t totalBlocos;
+    uint32_t capacidadeBlocos;
+    uint32_t usadosBloco;      // Nós ocupados no último bloco
+    uint32_t totalNos;
+    size_t tamNo;
+} ArenaNos;
+#endif
+
 // 1. Nó da Árvore Binária (Mapa - Cômodo)
+// Fora deste arquivo, leia os campos pelas funções de acesso (nomeSala(), salaEsquerda()...),
+// que funcionam nos dois modos.
+#ifndef MODO_COMPACTO
 typedef struct Sala {
     char nome[TAM_NOME_SALA];
     int temPista;
@@ -459,15 +525,32 @@ typedef struct Sala {
     struct Sala *esquerda; 
     struct Sala *direita;  
 } Sala;
+#else
+typedef struct Sala {
+    uint32_t nome;     // Deslocamento no pool de nomes do caso
+    uint32_t pista;    // SALA_TEM_PISTA | deslocamento do nome da pista (0 = sem pista)
+    IndiceNo esquerda; // Índice na arena de salas (INDICE_NULO = sem filho)
+    IndiceNo direita;
+} Sala;
+#endif
 
 // 2. Nó da Árvore Binária de Busca (Pistas)
+#ifndef MODO_COMPACTO
 typedef struct PistaNode {
     char nome[TAM_NOME_PISTA];
     struct PistaNode *esquerda; 
     struct PistaNode *direita;  
 } PistaNode;
+#else
+typedef struct PistaNode {
+    uint32_t nome;     // Deslocamento no pool de nomes do caso
+    IndiceNo esquerda; // Índice na arena de pistas (INDICE_NULO = sem filho)
+    IndiceNo direita;
+} PistaNode;
+#endif
 
 // 3. Estrutura para Tabela Hash (Vínculo Pista -> Suspeito)
+#ifndef MODO_COMPACTO
 // Nó da Lista Encadeada (usada para encadeamento da Hash)
 typedef struct HashNode {
     char pista[TAM_NOME_PISTA];
@@ -478,6 +561,97 @@ typedef struct HashNode {
 // Tabela Hash (Array de ponteiros para HashNode)
 typedef HashNode* TabelaHash[TAM_TABELA_HASH];
 
+typedef HashNode* CursorHash; // Nó de uma lista da Hash (ver inicioListaHash())
+#define FIM_LISTA_HASH NULL
+#else
+// Modo compacto: os nós vivem em uma arena (vetor) e se ligam por índices de 32 bits;
+// cada pista e cada suspeito é guardado uma única vez em um pool de nomes.
+// Os nomes devolvidos pelas buscas valem até liberarHash(), como no modo padrão.
+typedef struct HashNode {
+    uint32_t pista;    // Deslocamento no pool de nomes
+    uint32_t suspeito; // Deslocamento no pool de nomes
+    IndiceNo proximo;
+} HashNode;
+
+typedef struct {
+    PoolNomes nomes;
+    HashNode *nos; // Arena dos nós de todas as listas
+    uint32_t totalNos, capacidadeNos;
+    IndiceNo baldes[TAM_TABELA_HASH];
+} TabelaHashCompacta;
+
+// Vetor de um elemento: as funções continuam recebendo "TabelaHash hash" como no modo padrão
+typedef TabelaHashCompacta TabelaHash[1];
+
+typedef IndiceNo CursorHash;
+#define FIM_LISTA_HASH INDICE_NULO
+#endif
+
+// 4. Tabela Hash Congelada (Hash Perfeito Mínimo, estilo CHD)
+// Construída uma única vez sobre o conjunto final de pistas: cada busca faz
+// um hash da chave, uma sondagem e uma única comparação de verificação.
+// As chaves são posicionadas em m > n posições (carga < 1, o que torna a busca
+// por sementes rápida) e a posição é comprimida para [0, n) pelo rank no bitmap.
+#ifndef MODO_COMPACTO
+typedef struct {
+    char pista[TAM_NOME_PISTA];
+    char suspeito[TAM_NOME_SUSPEITO];
+} EntradaCongelada;
+#else
+typedef struct {
+    uint32_t pista;    // Deslocamento no pool de nomes da tabela congelada
+    uint32_t suspeito;
+} EntradaCongelada;
+#endif
+
+typedef struct {
+    uint32_t totalChaves;           // n: pistas distintas armazenadas
+    uint32_t totalBaldes;           // r: baldes da fase de deslocamento
+    uint32_t totalSlots;            // m: posições antes da compressão (m > n)
+    uint64_t assinatura;            // Resumo da Hash encadeada de origem (valida o reuso)
+    uint32_t *deslocamentos;        // Semente de deslocamento escolhida para cada balde
+    uint64_t *ocupadas;             // Bitmap das m posições: 1 = ocupada por uma chave
+    uint32_t *rankPalavras;         // Posições ocupadas antes de cada palavra do bitmap
+    EntradaCongelada *entradas;     // n entradas, na ordem das posições ocupadas
+#ifdef MODO_COMPACTO
+    PoolNomes nomes;                // Nomes das entradas (suspeitos repetidos guardados uma vez)
+#endif
+} TabelaHashCongelada;
+
+// 5. Escritor do Relatório de Evidências
+// Acumula a saída em blocos reutilizáveis e só faz chamada de sistema quando
+// todos estão cheios (ou no fim), evitando um printf por linha.
+typedef enum {
+    FORMATO_HUMANO,  // Texto legível com emojis e marcação (padrão)
+    FORMATO_NDJSON,  // Um objeto JSON por linha
+    FORMATO_BINARIO  // "DQRB" + versão, seguidos de registros com strings prefixadas pelo tamanho
+} FormatoRelatorio;
+
+typedef struct {
+    int fd;                                  // Descritor de saída (não é fechado pelo escritor)
+    FormatoRelatorio formato;
+    int usarWritev;                          // 1: descarrega todos os blocos com um único writev()
+    int erro;                                // 1 após a primeira falha de gravação
+    char *blocos[NUM_BLOCOS_RELATORIO];
+    int blocoAtual;                          // Bloco sendo preenchido
+    size_t usadoBloco;                       // Bytes ocupados no bloco atual
+} EscritorRelatorio;
+
+// 6. Contabilidade de Memória (bytes por estrutura, medidos igual nos dois modos)
+typedef struct {
+    size_t nos;        // Quantidade de nós (ou nomes distintos, no pool)
+    size_t usados;     // Bytes ocupados pelos dados (itens * tamanho do item)
+    size_t reservados; // Bytes dos blocos alocados (capacidade das arenas, sobra do malloc)
+} UsoMemoria;
+
+typedef struct {
+    UsoMemoria salas;
+    UsoMemoria pistas;
+    UsoMemoria hash;
+    UsoMemoria nomes;     // Pool de nomes da Hash (só existe no modo compacto)
+    UsoMemoria congelada; // Tabela Hash Congelada (deslocamentos, bitmap, rank e entradas)
+} RelatorioMemoria;
+
 
 // ============================================================================
 // --- Protótipos das Funções ---
@@ -488,33 +662,132 @@ Sala* criarSala(const char *nome, int temPista, const char *pista);
 void montarMapaEstatico(Sala **raiz, TabelaHash hashSuspeitos);
 void explorarSalas(Sala *raiz, PistaNode **pistasColetadas, TabelaHash hashSuspeitos);
 void liberarMapa(Sala *raiz);
+const char* nomeSala(const Sala *sala);
+int salaTemPista(const Sala *sala);
+const char* pistaDaSala(const Sala *sala);
+Sala* salaEsquerda(const Sala *sala);
+Sala* salaDireita(const Sala *sala);
+void ligarSalas(Sala *sala, Sala *esquerda, Sala *direita);
 
 // Funções da BST (Árvore de Busca)
 PistaNode* criarPistaNode(const char *nome);
 PistaNode* inserirPista(PistaNode *raiz, const char *nome);
 PistaNode* buscarPista(PistaNode *raiz, const char *nome);
-void listarPistasEmOrdem(PistaNode *raiz);
+void listarPistasEmOrdem(PistaNode *raiz, EscritorRelatorio *escritor);
 void liberarPistas(PistaNode *raiz);
+const char* nomePistaNode(const PistaNode *no);
+PistaNode* pistaEsquerda(const PistaNode *no);
+PistaNode* pistaDireita(const PistaNode *no);
 
 // Funções da Tabela Hash
 void inicializarHash(TabelaHash hash);
 int funcaoHash(const char *chave);
 void inserirNaHash(TabelaHash hash, const char *pista, const char *suspeito);
 const char* buscarSuspeito(TabelaHash hash, const char *pista);
-void analisarSuspeitos(TabelaHash hash, PistaNode *pistasColetadas);
+CursorHash inicioListaHash(TabelaHash hash, int balde);
+CursorHash proximoNaListaHash(TabelaHash hash, CursorHash no);
+const char* pistaNoHash(TabelaHash hash, CursorHash no);
+const char* suspeitoNoHash(TabelaHash hash, CursorHash no);
+void analisarSuspeitos(const TabelaHashCongelada *hash, PistaNode *pistasColetadas, EscritorRelatorio *escritor);
 void liberarHash(TabelaHash hash);
 
+// Funções da Tabela Hash Congelada (Hash Perfeito)
+int congelarHash(TabelaHash hash, TabelaHashCongelada *congelada);
+const char* buscarSuspeitoCongelado(const TabelaHashCongelada *congelada, const char *pista);
+int salvarHashCongelada(const TabelaHashCongelada *congelada, const char *caminho);
+int carregarHashCongelada(TabelaHashCongelada *congelada, const char *caminho);
+int hashCongeladaConfere(TabelaHash hash, const TabelaHashCongelada *congelada);
+void compararDesempenhoHash(TabelaHash hash, const TabelaHashCongelada *congelada, double tempoCarga,
+                            double tempoConstrucao);
+void liberarHashCongelada(TabelaHashCongelada *congelada);
+
+// Funções do Relatório (Escritor com Buffer)
+void inicializarEscritor(EscritorRelatorio *escritor, int fd, FormatoRelatorio formato, int usarWritev);
+void escreverBytes(EscritorRelatorio *escritor, const void *dados, size_t tam);
+int descarregarEscritor(EscritorRelatorio *escritor);
+void relatarTitulo(EscritorRelatorio *escritor, const char *titulo);
+void relatarPista(EscritorRelatorio *escritor, const char *pista, const char *suspeito, int comAssociacao);
+void relatarConclusao(EscritorRelatorio *escritor, const char *culpado, int evidencias);
+int liberarEscritor(EscritorRelatorio *escritor);
+
+// Funções de Contabilidade de Memória
+void contabilizarMemoria(Sala *mansao, PistaNode *pistas, TabelaHash hash, const TabelaHashCongelada *congelada,
+                         RelatorioMemoria *relatorio);
+void exibirRelatorioMemoria(const char *titulo, const RelatorioMemoria *relatorio);
+
+#ifdef MODO_COMPACTO
+// Funções do Modo Compacto (pool de nomes)
+uint32_t internarNome(PoolNomes *pool, const char *nome);
+const char* nomeNoPool(const PoolNomes *pool, uint32_t deslocamento);
+void fecharPoolNomes(PoolNomes *pool);
+void liberarPoolNomes(PoolNomes *pool);
+void contabilizarCasoCompacto(RelatorioMemoria *relatorio);
+#endif
+
 
 // ============================================================================
 // --- Função Principal (main) ---
 // ============================================================================
 
-int main() {
+/**
+ * Uso: detective [--formato=humano|ndjson|binario] [--saida=arquivo] [--writev] [--medir-hash]
+ *                 [--cache-hash=arquivo]
+ * --cache-hash reaproveita (ou grava) a Hash congelada nesse arquivo entre execuções.
+ * --medir-hash compara (em stderr) as buscas da Hash congelada com as da encadeada.
+ * O relatório legível vai para stdout por padrão. Os formatos ndjson/binario exigem
+ * --saida, pois a exploração interativa também escreve em stdout.
+ * Retorna 1 se o relatório não pôde ser gravado por completo.
+ */
+int main(int argc, char *argv[]) {
     setlocale(LC_ALL, "Portuguese");
     
     Sala *mansao = NULL;
     PistaNode *pistasColetadas = NULL;
+    FormatoRelatorio formato = FORMATO_HUMANO;
+    const char *caminhoSaida = NULL;
+    int usarWritev = 0;
+    int medirHash = 0;
+    const char *caminhoCacheHash = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--formato=humano") == 0) {
+            formato = FORMATO_HUMANO;
+        } else if (strcmp(argv[i], "--formato=ndjson") == 0) {
+            formato = FORMATO_NDJSON;
+        } else if (strcmp(argv[i], "--formato=binario") == 0) {
+            formato = FORMATO_BINARIO;
+        } else if (strncmp(argv[i], "--saida=", 8) == 0) {
+            caminhoSaida = argv[i] + 8;
+        } else if (strcmp(argv[i], "--writev") == 0) {
+            usarWritev = 1;
+        } else if (strcmp(argv[i], "--medir-hash") == 0) {
+            medirHash = 1;
+        } else if (strncmp(argv[i], "--cache-hash=", 13) == 0) {
+            caminhoCacheHash = argv[i] + 13;
+        } else {
+            fprintf(stderr, "Opção desconhecida: %s\n", argv[i]);
+            fprintf(stderr, "Uso: %s [--formato=humano|ndjson|binario] [--saida=arquivo] [--writev] [--medir-hash]"
+                    " [--cache-hash=arquivo]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (formato != FORMATO_HUMANO && caminhoSaida == NULL) {
+        fprintf(stderr, "Erro: os formatos ndjson e binario exigem --saida=arquivo.\n");
+        return 1;
+    }
+
+    // Abre o destino do relatório antes da exploração, para não perder a partida se falhar
+    int fdSaida = STDOUT_FILENO;
+    if (caminhoSaida != NULL) {
+        fdSaida = open(caminhoSaida, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fdSaida < 0) {
+            perror("Erro ao abrir o arquivo do relatório");
+            return 1;
+        }
+    }
+
     TabelaHash hashSuspeitos;
+    TabelaHashCongelada hashCongelada = {0};
     
     inicializarHash(hashSuspeitos);
     
@@ -528,35 +801,87 @@ int main() {
         return 1;
     }
 
+    // 1.1 Congelamento da Hash: o vínculo pista -> suspeito não muda durante o caso.
+    // Com --cache-hash, reaproveita a tabela salva em uma execução anterior quando ela ainda confere.
+    // Tempos negativos indicam etapa não executada (sem --cache-hash, ou tabela reaproveitada)
+    double tempoCarga = -1.0;
+    double tempoConstrucao = -1.0;
+    int carregada = 0;
+    if (caminhoCacheHash != NULL) {
+        clock_t inicio = clock();
+        carregada = carregarHashCongelada(&hashCongelada, caminhoCacheHash) &&
+                    hashCongeladaConfere(hashSuspeitos, &hashCongelada);
+        tempoCarga = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    }
+    if (!carregada) {
+        liberarHashCongelada(&hashCongelada);
+        clock_t inicio = clock();
+        if (!congelarHash(hashSuspeitos, &hashCongelada)) {
+            fprintf(stderr, "Erro ao congelar a tabela hash.\n");
+            return 1;
+        }
+        tempoConstrucao = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+        if (caminhoCacheHash != NULL) {
+            salvarHashCongelada(&hashCongelada, caminhoCacheHash);
+        }
+    }
+    if (medirHash) {
+        compararDesempenhoHash(hashSuspeitos, &hashCongelada, tempoCarga, tempoConstrucao);
+    }
+
     // 2. Iniciar a Exploração Interativa
     printf("Exploração iniciada no Hall de Entrada.\n");
     explorarSalas(mansao, &pistasColetadas, hashSuspeitos);
     
-    // 3. Análise Final e Solução
-    printf("\n\n**************************************************\n");
-    printf("🕵️ **ANÁLISE FINAL DE EVIDÊNCIAS** 🕵️\n");
-    printf("**************************************************\n");
-    analisarSuspeitos(hashSuspeitos, pistasColetadas);
-    printf("**************************************************\n");
-
-    // 4. Limpeza de Memória
+    // 3. Análise Final e Solução (transmitida pelo escritor do relatório)
+    int status = 0;
+    EscritorRelatorio relatorio;
+    inicializarEscritor(&relatorio, fdSaida, formato, usarWritev);
+
+    relatarTitulo(&relatorio, "\n\n**************************************************\n");
+    relatarTitulo(&relatorio, "🕵️ **ANÁLISE FINAL DE EVIDÊNCIAS** 🕵️\n");
+    relatarTitulo(&relatorio, "**************************************************\n");
+    analisarSuspeitos(&hashCongelada, pistasColetadas, &relatorio);
+    relatarTitulo(&relatorio, "**************************************************\n");
+
+    if (!liberarEscritor(&relatorio)) {
+        status = 1;
+    }
+    if (fdSaida != STDOUT_FILENO && close(fdSaida) != 0) {
+        perror("Erro ao fechar o arquivo do relatório");
+        status = 1;
+    }
+
+    // 4. Contabilidade de Memória (diagnóstico em stderr, fora do relatório)
+    RelatorioMemoria memoria;
+    contabilizarMemoria(mansao, pistasColetadas, hashSuspeitos, &hashCongelada, &memoria);
+#ifdef MODO_COMPACTO
+    exibirRelatorioMemoria("modo compacto", &memoria);
+#else
+    exibirRelatorioMemoria("modo padrão", &memoria);
+#endif
+
+    // 5. Limpeza de Memória
     liberarMapa(mansao);
     liberarPistas(pistasColetadas);
     liberarHash(hashSuspeitos);
+    liberarHashCongelada(&hashCongelada);
     printf("\n🧹 Memória liberada. Programa encerrado.\n");
 
-    return 0;
+    return status;
 }
 
 // ============================================================================
 // --- Implementação das Funções da Tabela Hash ---
 // ============================================================================
 
+#ifndef MODO_COMPACTO // No modo compacto, ver "Implementação das Funções do Modo Compacto"
 void inicializarHash(TabelaHash hash) {
     for (int i = 0; i < TAM_TABELA_HASH; i++) {
         hash[i] = NULL;
     }
 }
+#endif
 
 /**
  * @brief Função de espalhamento simples: soma dos valores ASCII dos 3 primeiros caracteres.
@@ -574,6 +899,7 @@ int funcaoHash(const char *chave) {
     return valor % TAM_TABELA_HASH;
 }
 
+#ifndef MODO_COMPACTO
 /**
  * @brief Insere um novo par (pista, suspeito) na Tabela Hash (Encadeamento Separado).
  */
@@ -615,11 +941,12 @@ const char* buscarSuspeito(TabelaHash hash, const char *pista) {
     
     return NULL; // Não encontrado
 }
+#endif
 
 /**
  * @brief Percorre a BST de pistas coletadas e usa a Hash para determinar o suspeito mais citado.
  */
-void analisarSuspeitos(TabelaHash hash, PistaNode *pistasColetadas) {
+void analisarSuspeitos(const TabelaHashCongelada *hash, PistaNode *pistasColetadas, EscritorRelatorio *escritor) {
     // Array para contar as ocorrências de cada suspeito (Simplificado para 3 suspeitos)
     struct Contagem {
         char nome[TAM_NOME_SUSPEITO];
@@ -631,20 +958,20 @@ void analisarSuspeitos(TabelaHash hash, PistaNode *pistasColetadas) {
         {"", 0} // Sentinela
     };
 
-    printf("Pistas e Associações:\n");
+    relatarTitulo(escritor, "Pistas e Associações:\n");
 
     // Usa um percurso InOrder (ou Pré-ordem) na BST para verificar todas as pistas
     // Função auxiliar recursiva para percorrer a BST e contar
     void contarSuspeito(PistaNode *node) {
         if (node == NULL) return;
         
-        contarSuspeito(node->esquerda);
+        contarSuspeito(pistaEsquerda(node));
         
-        const char *suspeitoEncontrado = buscarSuspeito(hash, node->nome);
+        const char *suspeitoEncontrado = buscarSuspeitoCongelado(hash, nomePistaNode(node));
         
+        relatarPista(escritor, nomePistaNode(node), suspeitoEncontrado, 1);
+
         if (suspeitoEncontrado != NULL) {
-            printf("  - %s: Associado a **%s**\n", node->nome, suspeitoEncontrado);
-            
             // Incrementa o contador do suspeito
             for (int i = 0; contadores[i].nome[0] != '\0'; i++) {
                 if (strcasecmp(contadores[i].nome, suspeitoEncontrado) == 0) {
@@ -652,11 +979,9 @@ void analisarSuspeitos(TabelaHash hash, PistaNode *pistasColetadas) {
                     break;
                 }
             }
-        } else {
-            printf("  - %s: Associa\u00e7\u00e3o n\u00e3o encontrada na Hash.\n", node->nome);
         }
 
-        contarSuspeito(node->direita);
+        contarSuspeito(pistaDireita(node));
     }
     
     contarSuspeito(pistasColetadas);
@@ -672,10 +997,10 @@ void analisarSuspeitos(TabelaHash hash, PistaNode *pistasColetadas) {
         }
     }
     
-    printf("\n🚨 **CONCLUS\u00c3O DA INVESTIGA\u00c7\u00c3O**\n");
-    printf("   O Suspeito mais citado nas pistas \u00e9: **%s** (%d evid\u00eancias).\n", culpado, maxContagem);
+    relatarConclusao(escritor, culpado, maxContagem);
 }
 
+#ifndef MODO_COMPACTO
 void liberarHash(TabelaHash hash) {
     for (int i = 0; i < TAM_TABELA_HASH; i++) {
         HashNode *atual = hash[i];
@@ -689,6 +1014,1538 @@ void liberarHash(TabelaHash hash) {
     }
 }
 
+/**
+ * @brief Acesso às listas da Hash sem depender da representação dos nós.
+ * Uso: for (CursorHash no = inicioListaHash(hash, i); no != FIM_LISTA_HASH; no = proximoNaListaHash(hash, no))
+ */
+CursorHash inicioListaHash(TabelaHash hash, int balde) {
+    return hash[balde];
+}
+
+CursorHash proximoNaListaHash(TabelaHash hash, CursorHash no) {
+    (void)hash;
+    return no->proximo;
+}
+
+const char* pistaNoHash(TabelaHash hash, CursorHash no) {
+    (void)hash;
+    return no->pista;
+}
+
+const char* suspeitoNoHash(TabelaHash hash, CursorHash no) {
+    (void)hash;
+    return no->suspeito;
+}
+#endif
+
+// ============================================================================
+// --- Implementação das Funções da Tabela Hash Congelada (Hash Perfeito) ---
+// ============================================================================
+
+/**
+ * @brief Finalizador do splitmix64: espalha todos os bits da entrada por toda a saída.
+ */
+static uint64_t misturarBits(uint64_t h) {
+    h ^= h >> 30; h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 27; h *= 0x94D049BB133111EBULL;
+    h ^= h >> 31;
+    return h;
+}
+
+/**
+ * @brief Hash de 64 bits de um texto (FNV-1a + finalizador splitmix64).
+ * @param ignorarCaixa 1 para tratar 'A'..'Z' como 'a'..'z' (semântica de strcasecmp).
+ */
+static uint64_t hashTexto(const char *texto, int ignorarCaixa) {
+    uint64_t h = 1469598103934665603ULL;
+    for (const unsigned char *c = (const unsigned char*)texto; *c != '\0'; c++) {
+        unsigned char ch = *c;
+        if (ignorarCaixa && ch >= 'A' && ch <= 'Z') ch += 'a' - 'A';
+        h ^= (uint64_t)ch;
+        h *= 1099511628211ULL;
+    }
+    return misturarBits(h);
+}
+
+/**
+ * @brief Hash da chave na Tabela Hash Congelada.
+ * buscarSuspeito() só procura (com strcasecmp) dentro da lista de funcaoHash(pista), que
+ * distingue maiúsculas: "Faca" e "faca" podem estar em listas diferentes, e "FACA" em uma
+ * terceira, vazia. A chave congelada é, portanto, o par (lista, pista sem distinção de caixa).
+ * Faz parte do formato serializado: alterá-la exige incrementar VERSAO_HASH_CONGELADA.
+ */
+static uint64_t hashChaveCongelada(const char *chave) {
+    return misturarBits(hashTexto(chave, 1) ^ (uint64_t)funcaoHash(chave));
+}
+
+/**
+ * @brief Igualdade de chaves congeladas: a mesma que a busca encadeada aplica (mesma lista + strcasecmp).
+ */
+static int mesmaChaveCongelada(const char *a, const char *b) {
+    return strcasecmp(a, b) == 0 && funcaoHash(a) == funcaoHash(b);
+}
+
+/**
+ * @brief Resume o conteúdo da Hash encadeada (pares pista -> suspeito, na ordem das listas).
+ * Uma tabela salva só é reaproveitada se foi congelada a partir do mesmo conteúdo.
+ */
+static uint64_t assinaturaHash(TabelaHash hash) {
+    uint64_t assinatura = (uint64_t)TAM_TABELA_HASH;
+    for (int i = 0; i < TAM_TABELA_HASH; i++) {
+        for (CursorHash no = inicioListaHash(hash, i); no != FIM_LISTA_HASH; no = proximoNaListaHash(hash, no)) {
+            // Sensível à caixa: mudar só a grafia de um nome também invalida a tabela salva
+            assinatura = (assinatura ^ hashTexto(pistaNoHash(hash, no), 0)) * 0x9E3779B97F4A7C15ULL;
+            assinatura = (assinatura ^ hashTexto(suspeitoNoHash(hash, no), 0)) * 0x9E3779B97F4A7C15ULL;
+        }
+        assinatura = (assinatura ^ (uint64_t)i) * 0x9E3779B97F4A7C15ULL; // Separa as listas
+    }
+    return assinatura;
+}
+
+/**
+ * @brief Reduz um valor de 32 bits ao intervalo [0, limite) sem divisão (multiplica e desloca).
+ */
+static uint32_t reduzirIntervalo(uint32_t valor, uint32_t limite) {
+    return (uint32_t)(((uint64_t)valor * limite) >> 32);
+}
+
+static uint32_t baldeCHD(uint64_t h, uint32_t totalBaldes) {
+    return reduzirIntervalo((uint32_t)(h >> 32), totalBaldes);
+}
+
+/**
+ * @brief Posição final da chave: o hash já calculado é remisturado com a semente do balde.
+ */
+static uint32_t posicaoCHD(uint64_t h, uint32_t deslocamento, uint32_t totalSlots) {
+    uint64_t x = (h ^ deslocamento) * 0x9E3779B97F4A7C15ULL;
+    return reduzirIntervalo((uint32_t)(x >> 32), totalSlots);
+}
+
+#define PALAVRAS_BITMAP(m) (((uint64_t)(m) + 63) / 64)
+
+static int posicaoOcupada(const uint64_t *ocupadas, uint32_t pos) {
+    return (int)((ocupadas[pos >> 6] >> (pos & 63)) & 1);
+}
+
+/**
+ * @brief Rank da posição: quantas posições ocupadas vêm antes dela (índice em entradas).
+ */
+static uint32_t rankCHD(const TabelaHashCongelada *congelada, uint32_t pos) {
+    uint64_t antes = congelada->ocupadas[pos >> 6] & ((1ULL << (pos & 63)) - 1);
+    return congelada->rankPalavras[pos >> 6] + (uint32_t)__builtin_popcountll(antes);
+}
+
+/**
+ * @brief Recalcula o diretório de rank a partir do bitmap.
+ * @return Total de posições ocupadas.
+ */
+static uint32_t montarRankCHD(TabelaHashCongelada *congelada) {
+    uint32_t acumulado = 0;
+    for (uint32_t i = 0; i < PALAVRAS_BITMAP(congelada->totalSlots); i++) {
+        congelada->rankPalavras[i] = acumulado;
+        acumulado += (uint32_t)__builtin_popcountll(congelada->ocupadas[i]);
+    }
+    return acumulado;
+}
+
+/**
+ * @brief Tenta posicionar todas as chaves nas totalSlots posições da tabela.
+ * Os baldes são processados do maior para o menor; para cada um procura-se o
+ * primeiro deslocamento que leve suas chaves a posições livres e distintas.
+ * Marca as posições em congelada->ocupadas e devolve a de cada chave em posicaoChave.
+ * @return 1 em caso de sucesso, 0 se algum balde não encontrou deslocamento.
+ */
+static int posicionarChavesCHD(TabelaHashCongelada *congelada, const uint64_t *hashes, const uint32_t *ordem,
+                               const uint32_t *inicioBalde, const uint32_t *baldesOrdenados,
+                               uint32_t *posicaoChave) {
+    uint32_t m = congelada->totalSlots;
+    uint32_t r = congelada->totalBaldes;
+    uint64_t *ocupadas = congelada->ocupadas;
+
+    for (uint32_t b = 0; b < r; b++) {
+        uint32_t balde = baldesOrdenados[b];
+        uint32_t ini = inicioBalde[balde];
+        uint32_t tam = inicioBalde[balde + 1] - ini;
+        if (tam == 0) {
+            break; // Os restantes também estão vazios (ordem decrescente de tamanho)
+        }
+
+        int encontrado = 0;
+        for (uint32_t d = 0; d < CHD_MAX_DESLOCAMENTOS && !encontrado; d++) {
+            uint32_t k;
+            for (k = 0; k < tam; k++) {
+                uint32_t pos = posicaoCHD(hashes[ordem[ini + k]], d, m);
+                if (posicaoOcupada(ocupadas, pos)) break;
+                ocupadas[pos >> 6] |= 1ULL << (pos & 63); // Reserva provisória: detecta colisão no próprio balde
+                posicaoChave[ordem[ini + k]] = pos;
+            }
+            if (k == tam) {
+                congelada->deslocamentos[balde] = d;
+                encontrado = 1;
+            } else {
+                while (k > 0) { // Desfaz as reservas provisórias
+                    uint32_t pos = posicaoChave[ordem[ini + --k]];
+                    ocupadas[pos >> 6] &= ~(1ULL << (pos & 63));
+                }
+            }
+        }
+        if (!encontrado) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Nomes de uma entrada congelada (no modo compacto, deslocamentos no pool da tabela).
+ */
+static const char* pistaEntrada(const TabelaHashCongelada *congelada, const EntradaCongelada *entrada) {
+#ifdef MODO_COMPACTO
+    return nomeNoPool(&congelada->nomes, entrada->pista);
+#else
+    (void)congelada;
+    return entrada->pista;
+#endif
+}
+
+static const char* suspeitoEntrada(const TabelaHashCongelada *congelada, const EntradaCongelada *entrada) {
+#ifdef MODO_COMPACTO
+    return nomeNoPool(&congelada->nomes, entrada->suspeito);
+#else
+    (void)congelada;
+    return entrada->suspeito;
+#endif
+}
+
+static void preencherEntrada(TabelaHashCongelada *congelada, EntradaCongelada *entrada,
+                             const char *pista, const char *suspeito) {
+#ifdef MODO_COMPACTO
+    entrada->pista = internarNome(&congelada->nomes, pista);
+    entrada->suspeito = internarNome(&congelada->nomes, suspeito);
+#else
+    (void)congelada;
+    snprintf(entrada->pista, TAM_NOME_PISTA, "%s", pista);
+    snprintf(entrada->suspeito, TAM_NOME_SUSPEITO, "%s", suspeito);
+#endif
+}
+
+/**
+ * @brief Congela a Tabela Hash encadeada em um hash perfeito mínimo (estilo CHD).
+ * Cada busca devolve o mesmo que buscarSuspeito() na Hash encadeada de origem.
+ * Usa m = n / carga posições; no caso raro de algum balde não caber, m cresce 25%.
+ * @return 1 em caso de sucesso, 0 caso contrário.
+ */
+int congelarHash(TabelaHash hash, TabelaHashCongelada *congelada) {
+    memset(congelada, 0, sizeof(*congelada));
+    congelada->assinatura = assinaturaHash(hash);
+
+    uint32_t total = 0;
+    for (int i = 0; i < TAM_TABELA_HASH; i++) {
+        for (CursorHash no = inicioListaHash(hash, i); no != FIM_LISTA_HASH; no = proximoNaListaHash(hash, no)) {
+            total++;
+        }
+    }
+
+    // As chaves apontam para os nomes da própria Hash: nada é copiado até a etapa 5
+    uint32_t capacidade = total > 0 ? total : 1;
+    const char **pistas = (const char**)malloc(sizeof(const char*) * capacidade);
+    const char **suspeitos = (const char**)malloc(sizeof(const char*) * capacidade);
+    uint64_t *hashes = (uint64_t*)malloc(sizeof(uint64_t) * capacidade);
+    uint32_t *ordem = (uint32_t*)malloc(sizeof(uint32_t) * capacidade);
+    if (pistas == NULL || suspeitos == NULL || hashes == NULL || ordem == NULL) {
+        perror("Erro ao alocar estruturas do hash perfeito");
+        exit(EXIT_FAILURE);
+    }
+
+    uint32_t n = 0;
+    // 1. Coleta as entradas com seus hashes (mais recentes primeiro em cada lista)
+    for (int i = 0; i < TAM_TABELA_HASH; i++) {
+        for (CursorHash no = inicioListaHash(hash, i); no != FIM_LISTA_HASH; no = proximoNaListaHash(hash, no)) {
+            pistas[n] = pistaNoHash(hash, no);
+            suspeitos[n] = suspeitoNoHash(hash, no);
+            hashes[n] = hashChaveCongelada(pistas[n]);
+            n++;
+        }
+    }
+
+    uint32_t r = (n + CHD_CHAVES_POR_BALDE - 1) / CHD_CHAVES_POR_BALDE;
+    if (r == 0) r = 1;
+    uint32_t *inicioBalde = (uint32_t*)calloc(r + 1, sizeof(uint32_t));
+    uint32_t *cursor = (uint32_t*)calloc(r + 1, sizeof(uint32_t));
+    uint32_t *baldesOrdenados = (uint32_t*)malloc(sizeof(uint32_t) * r);
+    if (inicioBalde == NULL || cursor == NULL || baldesOrdenados == NULL) {
+        perror("Erro ao alocar estruturas do hash perfeito");
+        exit(EXIT_FAILURE);
+    }
+
+    // 2. Distribui as chaves nos baldes (ordenação por contagem, estável)
+    for (uint32_t k = 0; k < n; k++) {
+        inicioBalde[baldeCHD(hashes[k], r) + 1]++;
+    }
+    for (uint32_t b = 0; b < r; b++) {
+        inicioBalde[b + 1] += inicioBalde[b];
+    }
+    memcpy(cursor, inicioBalde, sizeof(uint32_t) * r);
+    for (uint32_t k = 0; k < n; k++) {
+        ordem[cursor[baldeCHD(hashes[k], r)]++] = k;
+    }
+
+    // Chaves iguais (mesma lista e mesma pista sem distinção de caixa) caem no mesmo balde.
+    // Mantém só a primeira: a coleta segue cada lista a partir do início, então ela é a
+    // inserida por último naquela lista -- exatamente a que buscarSuspeito() encontra
+    // (pistas que só diferem na caixa mas caem em listas diferentes são chaves distintas)
+    uint32_t distintas = 0;
+    for (uint32_t b = 0; b < r; b++) {
+        uint32_t ini = inicioBalde[b];
+        inicioBalde[b] = distintas;
+        for (uint32_t k = ini; k < cursor[b]; k++) {
+            uint32_t j;
+            for (j = inicioBalde[b]; j < distintas; j++) {
+                if (hashes[ordem[j]] == hashes[ordem[k]] &&
+                    mesmaChaveCongelada(pistas[ordem[j]], pistas[ordem[k]])) break;
+            }
+            if (j == distintas) {
+                ordem[distintas++] = ordem[k];
+            }
+        }
+    }
+    inicioBalde[r] = distintas;
+    n = distintas;
+
+    // 3. Baldes em ordem decrescente de tamanho (ordenação por contagem dos tamanhos)
+    memset(cursor, 0, sizeof(uint32_t) * (r + 1));
+    uint32_t maiorBalde = 0;
+    for (uint32_t b = 0; b < r; b++) {
+        uint32_t tam = inicioBalde[b + 1] - inicioBalde[b];
+        if (tam > maiorBalde) maiorBalde = tam;
+    }
+    uint32_t *porTamanho = (uint32_t*)calloc(maiorBalde + 2, sizeof(uint32_t));
+    if (porTamanho == NULL) {
+        perror("Erro ao alocar estruturas do hash perfeito");
+        exit(EXIT_FAILURE);
+    }
+    for (uint32_t b = 0; b < r; b++) {
+        porTamanho[maiorBalde - (inicioBalde[b + 1] - inicioBalde[b]) + 1]++;
+    }
+    for (uint32_t t = 0; t <= maiorBalde; t++) {
+        porTamanho[t + 1] += porTamanho[t];
+    }
+    for (uint32_t b = 0; b < r; b++) {
+        baldesOrdenados[porTamanho[maiorBalde - (inicioBalde[b + 1] - inicioBalde[b])]++] = b;
+    }
+    free(porTamanho);
+
+    // 4. Procura os deslocamentos com carga < 1
+    uint32_t *posicaoChave = (uint32_t*)malloc(sizeof(uint32_t) * capacidade);
+    if (posicaoChave == NULL) {
+        perror("Erro ao alocar estruturas do hash perfeito");
+        exit(EXIT_FAILURE);
+    }
+    int sucesso = 0;
+    uint64_t m = (uint64_t)n * 100 / CHD_CARGA_PERCENTUAL + 1;
+    for (int tentativa = 0; !sucesso && tentativa < 8 && m < UINT32_MAX; tentativa++, m += m / 4 + 1) {
+        congelada->totalChaves = n;
+        congelada->totalBaldes = r;
+        congelada->totalSlots = (uint32_t)m;
+        congelada->deslocamentos = (uint32_t*)calloc(r, sizeof(uint32_t));
+        congelada->ocupadas = (uint64_t*)calloc(PALAVRAS_BITMAP(m), sizeof(uint64_t));
+        if (congelada->deslocamentos == NULL || congelada->ocupadas == NULL) {
+            perror("Erro ao alocar a tabela hash congelada");
+            exit(EXIT_FAILURE);
+        }
+
+        sucesso = posicionarChavesCHD(congelada, hashes, ordem, inicioBalde, baldesOrdenados, posicaoChave);
+        if (!sucesso) {
+            free(congelada->deslocamentos);
+            free(congelada->ocupadas);
+            congelada->deslocamentos = NULL;
+            congelada->ocupadas = NULL;
+        }
+    }
+
+    // 5. Comprime as posições para [0, n): cada chave vai para o rank da sua posição
+    if (sucesso) {
+        congelada->rankPalavras = (uint32_t*)malloc(sizeof(uint32_t) * PALAVRAS_BITMAP(congelada->totalSlots));
+        congelada->entradas = (EntradaCongelada*)malloc(sizeof(EntradaCongelada) * (n > 0 ? n : 1));
+        if (congelada->rankPalavras == NULL || congelada->entradas == NULL) {
+            perror("Erro ao alocar a tabela hash congelada");
+            exit(EXIT_FAILURE);
+        }
+        montarRankCHD(congelada);
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t k = ordem[i];
+            preencherEntrada(congelada, &congelada->entradas[rankCHD(congelada, posicaoChave[k])],
+                             pistas[k], suspeitos[k]);
+        }
+#ifdef MODO_COMPACTO
+        fecharPoolNomes(&congelada->nomes);
+#endif
+    }
+    free(posicaoChave);
+
+    free(pistas);
+    free(suspeitos);
+    free(hashes);
+    free(ordem);
+    free(inicioBalde);
+    free(cursor);
+    free(baldesOrdenados);
+    return sucesso;
+}
+
+/**
+ * @brief Busca o suspeito na Tabela Hash Congelada: um hash, uma sondagem, uma comparação.
+ * @return O nome do suspeito ou NULL se a pista não pertencer ao conjunto congelado.
+ */
+const char* buscarSuspeitoCongelado(const TabelaHashCongelada *congelada, const char *pista) {
+    uint64_t h = hashChaveCongelada(pista);
+    uint32_t deslocamento = congelada->deslocamentos[baldeCHD(h, congelada->totalBaldes)];
+    uint32_t pos = posicaoCHD(h, deslocamento, congelada->totalSlots);
+    if (!posicaoOcupada(congelada->ocupadas, pos)) {
+        return NULL;
+    }
+
+    // Verificação: pistas fora do conjunto também podem cair em uma posição ocupada
+    const EntradaCongelada *entrada = &congelada->entradas[rankCHD(congelada, pos)];
+    if (mesmaChaveCongelada(pistaEntrada(congelada, entrada), pista)) {
+        return suspeitoEntrada(congelada, entrada);
+    }
+    return NULL;
+}
+
+// --- Leitura e gravação little-endian (independentes da ordem de bytes do host) ---
+
+static int gravarU32(FILE *arquivo, uint32_t valor) {
+    unsigned char bytes[4];
+    for (int i = 0; i < 4; i++) bytes[i] = (unsigned char)(valor >> (8 * i));
+    return fwrite(bytes, 1, 4, arquivo) == 4;
+}
+
+static int gravarU64(FILE *arquivo, uint64_t valor) {
+    return gravarU32(arquivo, (uint32_t)valor) && gravarU32(arquivo, (uint32_t)(valor >> 32));
+}
+
+static int lerU32(FILE *arquivo, uint32_t *valor) {
+    unsigned char bytes[4];
+    if (fread(bytes, 1, 4, arquivo) != 4) return 0;
+    *valor = (uint32_t)bytes[0] | (uint32_t)bytes[1] << 8 | (uint32_t)bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+    return 1;
+}
+
+static int lerU64(FILE *arquivo, uint64_t *valor) {
+    uint32_t baixo, alto;
+    if (!lerU32(arquivo, &baixo) || !lerU32(arquivo, &alto)) return 0;
+    *valor = (uint64_t)alto << 32 | baixo;
+    return 1;
+}
+
+/**
+ * @brief Grava um nome como comprimento (1 byte) + bytes, sem o '\0' nem o resto do char[50].
+ */
+static int gravarNome(FILE *arquivo, const char *nome) {
+    size_t tam = strlen(nome);
+    unsigned char prefixo = (unsigned char)tam;
+    return fwrite(&prefixo, 1, 1, arquivo) == 1 && fwrite(nome, 1, tam, arquivo) == tam;
+}
+
+static int lerNome(FILE *arquivo, char *destino, size_t capacidade) {
+    unsigned char tam;
+    if (fread(&tam, 1, 1, arquivo) != 1 || tam >= capacidade) return 0;
+    if (fread(destino, 1, tam, arquivo) != tam) return 0;
+    destino[tam] = '\0';
+    return 1;
+}
+
+/**
+ * @brief Grava a Tabela Hash Congelada em arquivo binário para reuso entre execuções.
+ * Formato (little-endian): "DQPH", versão, n, r, m (uint32), assinatura (uint64),
+ * r deslocamentos (uint32), o bitmap das m posições (uint64 por 64 posições) e as
+ * n entradas (pista e suspeito como nomes prefixados pelo comprimento).
+ * @return 1 em caso de sucesso, 0 caso contrário.
+ */
+int salvarHashCongelada(const TabelaHashCongelada *congelada, const char *caminho) {
+    FILE *arquivo = fopen(caminho, "wb");
+    if (arquivo == NULL) {
+        perror("Erro ao salvar a tabela hash congelada");
+        return 0;
+    }
+
+    int ok = fwrite("DQPH", 1, 4, arquivo) == 4 &&
+             gravarU32(arquivo, VERSAO_HASH_CONGELADA) &&
+             gravarU32(arquivo, congelada->totalChaves) &&
+             gravarU32(arquivo, congelada->totalBaldes) &&
+             gravarU32(arquivo, congelada->totalSlots) &&
+             gravarU64(arquivo, congelada->assinatura);
+    for (uint32_t i = 0; ok && i < congelada->totalBaldes; i++) {
+        ok = gravarU32(arquivo, congelada->deslocamentos[i]);
+    }
+    for (uint32_t i = 0; ok && i < PALAVRAS_BITMAP(congelada->totalSlots); i++) {
+        ok = gravarU64(arquivo, congelada->ocupadas[i]);
+    }
+    for (uint32_t i = 0; ok && i < congelada->totalChaves; i++) {
+        ok = gravarNome(arquivo, pistaEntrada(congelada, &congelada->entradas[i])) &&
+             gravarNome(arquivo, suspeitoEntrada(congelada, &congelada->entradas[i]));
+    }
+
+    if (fclose(arquivo) != 0) ok = 0;
+    if (!ok) {
+        fprintf(stderr, "Erro ao gravar %s.\n", caminho);
+        remove(caminho);
+    }
+    return ok;
+}
+
+/**
+ * @brief Carrega uma Tabela Hash Congelada gravada por salvarHashCongelada().
+ * @return 1 em caso de sucesso; 0 se o arquivo não existir ou for inválido
+ *         (nesse caso a estrutura fica zerada e pode ser liberada com segurança).
+ */
+int carregarHashCongelada(TabelaHashCongelada *congelada, const char *caminho) {
+    memset(congelada, 0, sizeof(*congelada));
+
+    FILE *arquivo = fopen(caminho, "rb");
+    if (arquivo == NULL) {
+        return 0; // Primeira execução: ainda não há tabela salva
+    }
+
+    char magica[4];
+    uint32_t versao = 0;
+    int ok = fread(magica, 1, 4, arquivo) == 4 && memcmp(magica, "DQPH", 4) == 0 &&
+             lerU32(arquivo, &versao) && versao == VERSAO_HASH_CONGELADA &&
+             lerU32(arquivo, &congelada->totalChaves) &&
+             lerU32(arquivo, &congelada->totalBaldes) &&
+             lerU32(arquivo, &congelada->totalSlots) &&
+             lerU64(arquivo, &congelada->assinatura) &&
+             congelada->totalBaldes > 0 && congelada->totalSlots > 0 &&
+             congelada->totalChaves <= congelada->totalSlots;
+
+    // Antes de alocar, confere se n, r e m cabem no que resta do arquivo: cada deslocamento
+    // ocupa 4 bytes, cada palavra do bitmap 8 e cada entrada pelo menos 2 (dois prefixos).
+    // Um cabeçalho corrompido não pode provocar alocações de gigabytes.
+    size_t palavras = ok ? (size_t)PALAVRAS_BITMAP(congelada->totalSlots) : 0;
+    if (ok) {
+        uint64_t minimo = (uint64_t)congelada->totalBaldes * 4 + (uint64_t)palavras * 8 +
+                          (uint64_t)congelada->totalChaves * 2;
+        long atual = ftell(arquivo);
+        ok = atual >= 0 && fseek(arquivo, 0, SEEK_END) == 0;
+        long fim = ok ? ftell(arquivo) : -1;
+        ok = ok && fim >= atual && fseek(arquivo, atual, SEEK_SET) == 0 &&
+             minimo <= (uint64_t)(fim - atual);
+    }
+    if (ok) {
+        congelada->deslocamentos = (uint32_t*)malloc(sizeof(uint32_t) * (size_t)congelada->totalBaldes);
+        congelada->ocupadas = (uint64_t*)malloc(sizeof(uint64_t) * palavras);
+        congelada->rankPalavras = (uint32_t*)malloc(sizeof(uint32_t) * palavras);
+        congelada->entradas = (EntradaCongelada*)malloc(sizeof(EntradaCongelada) *
+                                                        ((size_t)congelada->totalChaves + 1));
+        ok = congelada->deslocamentos != NULL && congelada->ocupadas != NULL &&
+             congelada->rankPalavras != NULL && congelada->entradas != NULL;
+    }
+    for (uint32_t i = 0; ok && i < congelada->totalBaldes; i++) {
+        ok = lerU32(arquivo, &congelada->deslocamentos[i]);
+    }
+    for (size_t i = 0; ok && i < palavras; i++) {
+        ok = lerU64(arquivo, &congelada->ocupadas[i]);
+    }
+    if (ok && congelada->totalSlots % 64 != 0) {
+        congelada->ocupadas[palavras - 1] &= (1ULL << (congelada->totalSlots % 64)) - 1; // Bits além de m
+    }
+    // O bitmap precisa marcar exatamente n posições, uma por entrada
+    ok = ok && montarRankCHD(congelada) == congelada->totalChaves;
+    for (uint32_t i = 0; ok && i < congelada->totalChaves; i++) {
+        char pista[TAM_NOME_PISTA];
+        char suspeito[TAM_NOME_SUSPEITO];
+        ok = lerNome(arquivo, pista, TAM_NOME_PISTA) && lerNome(arquivo, suspeito, TAM_NOME_SUSPEITO);
+        if (ok) preencherEntrada(congelada, &congelada->entradas[i], pista, suspeito);
+    }
+#ifdef MODO_COMPACTO
+    fecharPoolNomes(&congelada->nomes);
+#endif
+
+    fclose(arquivo);
+    if (!ok) {
+        fprintf(stderr, "Aviso: %s inválido, a tabela será reconstruída.\n", caminho);
+        liberarHashCongelada(congelada);
+    }
+    return ok;
+}
+
+/**
+ * @brief Confere se a Tabela Hash Congelada foi construída a partir desta Hash encadeada.
+ * Usada para descartar uma tabela salva que não corresponde mais ao caso atual.
+ */
+int hashCongeladaConfere(TabelaHash hash, const TabelaHashCongelada *congelada) {
+    return congelada->assinatura == assinaturaHash(hash);
+}
+
+/**
+ * @brief Mede buscas sobre as pistas congeladas até REPETICOES_MEDICAO ou TEMPO_MAX_MEDICAO.
+ * @param buscas Recebe o número de buscas feitas.
+ * @return Segundos gastos.
+ */
+static double medirBuscas(TabelaHash hash, const TabelaHashCongelada *congelada, int usarCongelada, int *buscas) {
+    const char * volatile resultado = NULL;
+    clock_t inicio = clock();
+    clock_t limite = inicio + (clock_t)(TEMPO_MAX_MEDICAO * CLOCKS_PER_SEC);
+    int rep;
+    for (rep = 0; rep < REPETICOES_MEDICAO; rep++) {
+        // Passo multiplicativo: mesmo com poucas buscas, as chaves se espalham por toda a tabela
+        uint32_t k = (uint32_t)(((uint64_t)rep * 2654435761u) % congelada->totalChaves);
+        const char *pista = pistaEntrada(congelada, &congelada->entradas[k]);
+        resultado = usarCongelada ? buscarSuspeitoCongelado(congelada, pista) : buscarSuspeito(hash, pista);
+        if ((rep & 255) == 255 && clock() > limite) {
+            rep++;
+            break;
+        }
+    }
+    (void)resultado;
+    *buscas = rep;
+    return (double)(clock() - inicio) / CLOCKS_PER_SEC;
+}
+
+/**
+ * @brief Relata em stderr a carga do cache, a construção e o custo por busca das duas tabelas.
+ * Só roda com --medir-hash. Cada medição para em TEMPO_MAX_MEDICAO segundos, pois a busca
+ * encadeada percorre listas de ~n/7 nós; o ganho é calculado por busca, não pelo tempo total.
+ * @param tempoCarga Segundos para carregar e conferir o cache (negativo: sem --cache-hash).
+ * @param tempoConstrucao Segundos de congelarHash() (negativo: tabela reaproveitada do cache).
+ */
+void compararDesempenhoHash(TabelaHash hash, const TabelaHashCongelada *congelada, double tempoCarga,
+                            double tempoConstrucao) {
+    fprintf(stderr, "Hash congelada: %u pistas em %u posições (%u baldes).\n",
+            congelada->totalChaves, congelada->totalSlots, congelada->totalBaldes);
+    if (tempoCarga >= 0.0) {
+        fprintf(stderr, "  Cache: %.3f ms (%s).\n", tempoCarga * 1000.0,
+                tempoConstrucao < 0.0 ? "reaproveitado" : "ausente ou desatualizado");
+    }
+    if (tempoConstrucao >= 0.0) {
+        fprintf(stderr, "  Construção: %.3f ms.\n", tempoConstrucao * 1000.0);
+    }
+
+    if (congelada->totalChaves == 0) {
+        return;
+    }
+
+    // Mede as duas tabelas sobre as mesmas chaves (as pistas congeladas)
+    int buscasEncadeada = 0;
+    int buscasCongelada = 0;
+    double tempoEncadeada = medirBuscas(hash, congelada, 0, &buscasEncadeada);
+    double tempoCongelada = medirBuscas(hash, congelada, 1, &buscasCongelada);
+    double nsEncadeada = tempoEncadeada * 1e9 / buscasEncadeada;
+    double nsCongelada = tempoCongelada * 1e9 / buscasCongelada;
+
+    fprintf(stderr, "  Buscas: encadeada %.1f ns (%d buscas), congelada %.1f ns (%d buscas)",
+            nsEncadeada, buscasEncadeada, nsCongelada, buscasCongelada);
+    if (nsCongelada > 0.0) {
+        fprintf(stderr, " -> %.2fx", nsEncadeada / nsCongelada);
+    }
+    fprintf(stderr, ".\n");
+}
+
+void liberarHashCongelada(TabelaHashCongelada *congelada) {
+    free(congelada->deslocamentos);
+    free(congelada->ocupadas);
+    free(congelada->rankPalavras);
+    free(congelada->entradas);
+#ifdef MODO_COMPACTO
+    liberarPoolNomes(&congelada->nomes);
+#endif
+    memset(congelada, 0, sizeof(*congelada));
+}
+
+// ============================================================================
+// --- Implementação das Funções do Relatório (Escritor com Buffer) ---
+// ============================================================================
+
+/**
+ * @brief Prepara o escritor: aloca os blocos do buffer uma única vez para todo o relatório.
+ * No formato binário grava o cabeçalho "DQRB" + versão logo de início.
+ */
+void inicializarEscritor(EscritorRelatorio *escritor, int fd, FormatoRelatorio formato, int usarWritev) {
+    escritor->fd = fd;
+    escritor->formato = formato;
+    escritor->usarWritev = usarWritev;
+    escritor->erro = 0;
+    escritor->blocoAtual = 0;
+    escritor->usadoBloco = 0;
+
+    for (int i = 0; i < NUM_BLOCOS_RELATORIO; i++) {
+        escritor->blocos[i] = (char*)malloc(TAM_BLOCO_RELATORIO);
+        if (escritor->blocos[i] == NULL) {
+            perror("Erro ao alocar buffer do relatório");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (formato == FORMATO_BINARIO) {
+        unsigned char cabecalho[5] = { 'D', 'Q', 'R', 'B', VERSAO_RELATORIO_BINARIO };
+        escreverBytes(escritor, cabecalho, sizeof(cabecalho));
+    }
+}
+
+/**
+ * @brief Grava todos os bytes acumulados no descritor de saída.
+ * Com usarWritev, todos os blocos cheios vão em uma única chamada writev();
+ * sem ele, cada bloco é gravado com write(). Escritas parciais são retomadas.
+ * @return 1 em caso de sucesso, 0 se a gravação falhou.
+ */
+int descarregarEscritor(EscritorRelatorio *escritor) {
+    struct iovec partes[NUM_BLOCOS_RELATORIO];
+    int total = 0;
+
+    // O texto interativo sai por printf: esvazia o stdio antes para manter a ordem
+    if (escritor->fd == STDOUT_FILENO) {
+        fflush(stdout);
+    }
+
+    for (int i = 0; i <= escritor->blocoAtual && i < NUM_BLOCOS_RELATORIO; i++) {
+        size_t tam = (i < escritor->blocoAtual) ? TAM_BLOCO_RELATORIO : escritor->usadoBloco;
+        if (tam == 0) continue;
+        partes[total].iov_base = escritor->blocos[i];
+        partes[total].iov_len = tam;
+        total++;
+    }
+
+    int primeira = 0;
+    while (primeira < total && !escritor->erro) {
+        ssize_t gravados = escritor->usarWritev
+            ? writev(escritor->fd, &partes[primeira], total - primeira)
+            : write(escritor->fd, partes[primeira].iov_base, partes[primeira].iov_len);
+        if (gravados < 0) {
+            if (errno == EINTR) continue;
+            perror("Erro ao gravar o relatório");
+            escritor->erro = 1;
+            break;
+        }
+        // Avança pelas partes já gravadas (a última pode ter sido parcial)
+        while (primeira < total && (size_t)gravados >= partes[primeira].iov_len) {
+            gravados -= (ssize_t)partes[primeira].iov_len;
+            primeira++;
+        }
+        if (primeira < total) {
+            partes[primeira].iov_base = (char*)partes[primeira].iov_base + gravados;
+            partes[primeira].iov_len -= (size_t)gravados;
+        }
+    }
+
+    escritor->blocoAtual = 0;
+    escritor->usadoBloco = 0;
+    return !escritor->erro;
+}
+
+/**
+ * @brief Copia bytes para o buffer, passando ao próximo bloco quando o atual enche.
+ * Só há chamada de sistema quando todos os blocos estão cheios.
+ */
+void escreverBytes(EscritorRelatorio *escritor, const void *dados, size_t tam) {
+    const char *origem = (const char*)dados;
+    while (tam > 0) {
+        if (escritor->usadoBloco == TAM_BLOCO_RELATORIO) {
+            escritor->blocoAtual++;
+            escritor->usadoBloco = 0;
+            if (escritor->blocoAtual == NUM_BLOCOS_RELATORIO) {
+                descarregarEscritor(escritor);
+            }
+        }
+        size_t livre = TAM_BLOCO_RELATORIO - escritor->usadoBloco;
+        size_t parte = tam < livre ? tam : livre;
+        memcpy(escritor->blocos[escritor->blocoAtual] + escritor->usadoBloco, origem, parte);
+        escritor->usadoBloco += parte;
+        origem += parte;
+        tam -= parte;
+    }
+}
+
+static void escreverTexto(EscritorRelatorio *escritor, const char *texto) {
+    escreverBytes(escritor, texto, strlen(texto));
+}
+
+static void escreverInteiro(EscritorRelatorio *escritor, int valor) {
+    char digitos[12];
+    int pos = sizeof(digitos);
+    unsigned int v = valor < 0 ? 0u - (unsigned int)valor : (unsigned int)valor;
+    do {
+        digitos[--pos] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v > 0);
+    if (valor < 0) digitos[--pos] = '-';
+    escreverBytes(escritor, digitos + pos, sizeof(digitos) - pos);
+}
+
+/**
+ * @brief Escreve uma string JSON entre aspas, escapando aspas, barras e caracteres de controle.
+ */
+static void escreverTextoJson(EscritorRelatorio *escritor, const char *texto) {
+    static const char hex[] = "0123456789abcdef";
+    const char *inicio = texto;
+
+    escreverBytes(escritor, "\"", 1);
+    for (const char *c = texto; *c != '\0'; c++) {
+        unsigned char ch = (unsigned char)*c;
+        if (ch != '"' && ch != '\\' && ch >= 0x20) continue;
+
+        escreverBytes(escritor, inicio, (size_t)(c - inicio)); // Trecho sem escape, de uma vez
+        if (ch == '"' || ch == '\\') {
+            char escape[2] = { '\\', (char)ch };
+            escreverBytes(escritor, escape, 2);
+        } else {
+            char escape[6] = { '\\', 'u', '0', '0', hex[ch >> 4], hex[ch & 0xF] };
+            escreverBytes(escritor, escape, 6);
+        }
+        inicio = c + 1;
+    }
+    escreverBytes(escritor, inicio, strlen(inicio));
+    escreverBytes(escritor, "\"", 1);
+}
+
+/**
+ * @brief Escreve uma string no formato binário: comprimento (uint16, little-endian) + bytes.
+ */
+static void escreverTextoBinario(EscritorRelatorio *escritor, const char *texto) {
+    size_t tam = strlen(texto);
+    if (tam > 0xFFFF) tam = 0xFFFF;
+    unsigned char prefixo[2] = { (unsigned char)(tam & 0xFF), (unsigned char)(tam >> 8) };
+    escreverBytes(escritor, prefixo, 2);
+    escreverBytes(escritor, texto, tam);
+}
+
+/**
+ * @brief Linha de título (banners e separadores): só existe no formato legível.
+ */
+void relatarTitulo(EscritorRelatorio *escritor, const char *titulo) {
+    if (escritor->formato == FORMATO_HUMANO) {
+        escreverTexto(escritor, titulo);
+    }
+}
+
+/**
+ * @brief Registra uma pista e seu suspeito (NULL: sem suspeito, ou associação não encontrada).
+ * @param comAssociacao 0 para listagens simples de pistas, 1 para a análise pista -> suspeito.
+ */
+void relatarPista(EscritorRelatorio *escritor, const char *pista, const char *suspeito, int comAssociacao) {
+    switch (escritor->formato) {
+        case FORMATO_HUMANO:
+            escreverTexto(escritor, "  - ");
+            escreverTexto(escritor, pista);
+            if (!comAssociacao) {
+                escreverBytes(escritor, "\n", 1);
+            } else if (suspeito != NULL) {
+                escreverTexto(escritor, ": Associado a **");
+                escreverTexto(escritor, suspeito);
+                escreverTexto(escritor, "**\n");
+            } else {
+                escreverTexto(escritor, ": Associação não encontrada na Hash.\n");
+            }
+            break;
+
+        case FORMATO_NDJSON:
+            escreverTexto(escritor, "{\"pista\":");
+            escreverTextoJson(escritor, pista);
+            if (comAssociacao) {
+                escreverTexto(escritor, ",\"suspeito\":");
+                if (suspeito != NULL) {
+                    escreverTextoJson(escritor, suspeito);
+                } else {
+                    escreverTexto(escritor, "null");
+                }
+            }
+            escreverTexto(escritor, "}\n");
+            break;
+
+        case FORMATO_BINARIO: {
+            // Registro: tipo (1 byte), pista e, só em REGISTRO_BINARIO_ASSOCIACAO, o suspeito.
+            // A falta de associação tem tipo próprio, para não se confundir com um nome vazio.
+            unsigned char tipo = !comAssociacao ? REGISTRO_BINARIO_PISTA
+                               : suspeito != NULL ? REGISTRO_BINARIO_ASSOCIACAO
+                               : REGISTRO_BINARIO_SEM_ASSOCIACAO;
+            escreverBytes(escritor, &tipo, 1);
+            escreverTextoBinario(escritor, pista);
+            if (tipo == REGISTRO_BINARIO_ASSOCIACAO) {
+                escreverTextoBinario(escritor, suspeito);
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Registra a conclusão da investigação (suspeito mais citado e número de evidências).
+ */
+void relatarConclusao(EscritorRelatorio *escritor, const char *culpado, int evidencias) {
+    switch (escritor->formato) {
+        case FORMATO_HUMANO:
+            escreverTexto(escritor, "\n🚨 **CONCLUSÃO DA INVESTIGAÇÃO**\n");
+            escreverTexto(escritor, "   O Suspeito mais citado nas pistas é: **");
+            escreverTexto(escritor, culpado);
+            escreverTexto(escritor, "** (");
+            escreverInteiro(escritor, evidencias);
+            escreverTexto(escritor, " evidências).\n");
+            break;
+
+        case FORMATO_NDJSON:
+            escreverTexto(escritor, "{\"culpado\":");
+            escreverTextoJson(escritor, culpado);
+            escreverTexto(escritor, ",\"evidencias\":");
+            escreverInteiro(escritor, evidencias);
+            escreverTexto(escritor, "}\n");
+            break;
+
+        case FORMATO_BINARIO: {
+            unsigned char tipo = REGISTRO_BINARIO_CONCLUSAO;
+            uint32_t v = (uint32_t)evidencias;
+            unsigned char contagem[4] = { (unsigned char)v, (unsigned char)(v >> 8),
+                                          (unsigned char)(v >> 16), (unsigned char)(v >> 24) };
+            escreverBytes(escritor, &tipo, 1);
+            escreverTextoBinario(escritor, culpado);
+            escreverBytes(escritor, contagem, 4);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Descarrega o que restou no buffer e libera os blocos.
+ * Não fecha o descritor: quem o abriu é responsável por fechá-lo.
+ * @return 1 se todo o relatório foi gravado, 0 se alguma gravação falhou.
+ */
+int liberarEscritor(EscritorRelatorio *escritor) {
+    int ok = descarregarEscritor(escritor);
+    for (int i = 0; i < NUM_BLOCOS_RELATORIO; i++) {
+        free(escritor->blocos[i]);
+        escritor->blocos[i] = NULL;
+    }
+    return ok;
+}
+
+/**
+ * @brief Percorre a BST em ordem alfabética enviando cada pista ao escritor do relatório.
+ */
+void listarPistasEmOrdem(PistaNode *raiz, EscritorRelatorio *escritor) {
+    if (raiz == NULL) {
+        return;
+    }
+    listarPistasEmOrdem(pistaEsquerda(raiz), escritor);
+    relatarPista(escritor, nomePistaNode(raiz), NULL, 0);
+    listarPistasEmOrdem(pistaDireita(raiz), escritor);
+}
+
+// ============================================================================
+// --- Implementação das Funções de Contabilidade de Memória ---
+// ============================================================================
+
+/**
+ * @brief Soma um bloco ao uso: "usados" é o que os dados ocupam; "reservados" é o tamanho
+ * do bloco no alocador (malloc_usable_size() na glibc, senão o tamanho pedido).
+ */
+static void somarBloco(UsoMemoria *uso, const void *bloco, size_t usados, size_t pedidos) {
+    if (bloco == NULL) return;
+    uso->usados += usados;
+#ifdef __GLIBC__
+    (void)pedidos;
+    uso->reservados += malloc_usable_size((void*)bloco);
+#else
+    uso->reservados += pedidos;
+#endif
+}
+
+#ifdef MODO_COMPACTO
+static uint32_t tamBlocoNomes(uint32_t bloco);
+
+static void medirPoolNomes(const PoolNomes *pool, UsoMemoria *uso) {
+    uso->nos += pool->totalNomes;
+    uso->usados += pool->bytesNomes;
+    for (uint32_t b = 0; b < pool->totalBlocos; b++) {
+        somarBloco(uso, pool->blocos[b], 0, tamBlocoNomes(b));
+    }
+    somarBloco(uso, pool->blocos, (size_t)pool->totalBlocos * sizeof(char*),
+               (size_t)pool->capacidadeBlocos * sizeof(char*));
+    somarBloco(uso, pool->indice, (size_t)pool->totalNomes * sizeof(uint32_t),
+               (size_t)pool->capacidadeIndice * sizeof(uint32_t));
+}
+#else
+static void medirSalas(Sala *raiz, UsoMemoria *uso) {
+    if (raiz == NULL) return;
+    uso->nos++;
+    somarBloco(uso, raiz, sizeof(Sala), sizeof(Sala));
+    medirSalas(salaEsquerda(raiz), uso);
+    medirSalas(salaDireita(raiz), uso);
+}
+
+static void medirPistas(PistaNode *raiz, UsoMemoria *uso) {
+    if (raiz == NULL) return;
+    uso->nos++;
+    somarBloco(uso, raiz, sizeof(PistaNode), sizeof(PistaNode));
+    medirPistas(pistaEsquerda(raiz), uso);
+    medirPistas(pistaDireita(raiz), uso);
+}
+#endif
+
+/**
+ * @brief Contabiliza, para cada estrutura, os bytes usados e os reservados.
+ * Um nó alocado sozinho reserva pelo menos o seu tamanho; uma arena reserva a
+ * capacidade inteira. No modo padrão os nomes ficam embutidos nos nós, por isso a
+ * linha "Nomes" fica zerada; no compacto ela soma o pool do caso e o da Hash.
+ */
+void contabilizarMemoria(Sala *mansao, PistaNode *pistas, TabelaHash hash, const TabelaHashCongelada *congelada,
+                         RelatorioMemoria *relatorio) {
+    memset(relatorio, 0, sizeof(*relatorio));
+#ifdef MODO_COMPACTO
+    // Todas as salas e pistas do caso vivem nas arenas do caso
+    (void)mansao;
+    (void)pistas;
+    contabilizarCasoCompacto(relatorio);
+#else
+    medirSalas(mansao, &relatorio->salas);
+    medirPistas(pistas, &relatorio->pistas);
+#endif
+
+    // A Hash: os baldes ficam no próprio TabelaHash (na pilha de main)
+    relatorio->hash.usados = sizeof(TabelaHash);
+    relatorio->hash.reservados = sizeof(TabelaHash);
+#ifdef MODO_COMPACTO
+    relatorio->hash.nos = hash->totalNos;
+    somarBloco(&relatorio->hash, hash->nos, (size_t)hash->totalNos * sizeof(HashNode),
+               (size_t)hash->capacidadeNos * sizeof(HashNode));
+    medirPoolNomes(&hash->nomes, &relatorio->nomes);
+#else
+    for (int i = 0; i < TAM_TABELA_HASH; i++) {
+        for (HashNode *atual = hash[i]; atual != NULL; atual = atual->proximo) {
+            relatorio->hash.nos++;
+            somarBloco(&relatorio->hash, atual, sizeof(HashNode), sizeof(HashNode));
+        }
+    }
+#endif
+
+    // A Tabela Hash Congelada (um nó por pista distinta)
+    size_t palavras = PALAVRAS_BITMAP((size_t)congelada->totalSlots);
+    relatorio->congelada.nos = congelada->totalChaves;
+    relatorio->congelada.usados = relatorio->congelada.reservados = sizeof(*congelada);
+    somarBloco(&relatorio->congelada, congelada->deslocamentos, (size_t)congelada->totalBaldes * sizeof(uint32_t),
+               (size_t)congelada->totalBaldes * sizeof(uint32_t));
+    somarBloco(&relatorio->congelada, congelada->ocupadas, palavras * sizeof(uint64_t), palavras * sizeof(uint64_t));
+    somarBloco(&relatorio->congelada, congelada->rankPalavras, palavras * sizeof(uint32_t), palavras * sizeof(uint32_t));
+    somarBloco(&relatorio->congelada, congelada->entradas, (size_t)congelada->totalChaves * sizeof(EntradaCongelada),
+               (size_t)congelada->totalChaves * sizeof(EntradaCongelada));
+#ifdef MODO_COMPACTO
+    UsoMemoria nomesCongelada = {0, 0, 0};
+    medirPoolNomes(&congelada->nomes, &nomesCongelada);
+    relatorio->congelada.usados += nomesCongelada.usados;
+    relatorio->congelada.reservados += nomesCongelada.reservados;
+#endif
+}
+
+static void exibirLinhaMemoria(const char *estrutura, const UsoMemoria *uso) {
+    fprintf(stderr, "  %-10s %10zu nós %12zu usados %12zu reservados", estrutura, uso->nos, uso->usados, uso->reservados);
+    if (uso->nos > 0) {
+        fprintf(stderr, " (%.1f bytes/nó)", (double)uso->reservados / (double)uso->nos);
+    }
+    fprintf(stderr, "\n");
+}
+
+/**
+ * @brief Exibe em stderr o relatório de memória: nós, bytes usados e reservados de cada estrutura.
+ */
+void exibirRelatorioMemoria(const char *titulo, const RelatorioMemoria *relatorio) {
+    const UsoMemoria *linhas[] = { &relatorio->salas, &relatorio->pistas, &relatorio->hash,
+                                   &relatorio->nomes, &relatorio->congelada };
+    UsoMemoria total = {0, 0, 0};
+    for (size_t i = 0; i < sizeof(linhas) / sizeof(linhas[0]); i++) {
+        total.usados += linhas[i]->usados;
+        total.reservados += linhas[i]->reservados;
+    }
+
+    fprintf(stderr, "📦 Memória - %s:\n", titulo);
+    exibirLinhaMemoria("Salas", &relatorio->salas);
+    exibirLinhaMemoria("Pistas", &relatorio->pistas);
+    exibirLinhaMemoria("Hash", &relatorio->hash);
+    exibirLinhaMemoria("Nomes", &relatorio->nomes);
+    exibirLinhaMemoria("Congelada", &relatorio->congelada);
+    fprintf(stderr, "  %-10s %27zu usados %12zu reservados\n", "Total", total.usados, total.reservados);
+}
+
+#ifndef MODO_COMPACTO
+// ============================================================================
+// --- Implementação do Acesso aos Nós do Mapa e da BST ---
+// ============================================================================
+
+const char* nomeSala(const Sala *sala) {
+    return sala->nome;
+}
+
+int salaTemPista(const Sala *sala) {
+    return sala->temPista;
+}
+
+const char* pistaDaSala(const Sala *sala) {
+    return sala->pistaEncontrada;
+}
+
+Sala* salaEsquerda(const Sala *sala) {
+    return sala->esquerda;
+}
+
+Sala* salaDireita(const Sala *sala) {
+    return sala->direita;
+}
+
+void ligarSalas(Sala *sala, Sala *esquerda, Sala *direita) {
+    sala->esquerda = esquerda;
+    sala->direita = direita;
+}
+
+const char* nomePistaNode(const PistaNode *no) {
+    return no->nome;
+}
+
+PistaNode* pistaEsquerda(const PistaNode *no) {
+    return no->esquerda;
+}
+
+PistaNode* pistaDireita(const PistaNode *no) {
+    return no->direita;
+}
+#endif
+
+#ifdef MODO_COMPACTO
+// ============================================================================
+// --- Implementação das Funções do Modo Compacto ---
+// ============================================================================
+
+/**
+ * @brief Garante espaço para mais um item em uma arena (vetor que dobra de tamanho).
+ * Os nós se referem uns aos outros por índice, então mover a arena no realloc é seguro.
+ */
+static void* reservarNaArena(void *arena, uint32_t total, uint32_t *capacidade, size_t tamItem) {
+    if (total < *capacidade) {
+        return arena;
+    }
+    // Dobra em 64 bits: com 32 bits, 2^31 * 2 voltaria a 0 e a arena "encolheria"
+    uint64_t novaCapacidade = *capacidade > 0 ? (uint64_t)*capacidade * 2 : 16;
+    if (novaCapacidade > INDICE_NULO) {
+        novaCapacidade = INDICE_NULO; // INDICE_NULO é reservado: cabem índices até INDICE_NULO - 1
+    }
+    if (novaCapacidade <= total || novaCapacidade > SIZE_MAX / tamItem) {
+        fprintf(stderr, "Erro: limite de índices de 32 bits atingido.\n");
+        exit(EXIT_FAILURE);
+    }
+    void *nova = realloc(arena, (size_t)novaCapacidade * tamItem);
+    if (nova == NULL) {
+        perror("Erro ao ampliar arena do modo compacto");
+        exit(EXIT_FAILURE);
+    }
+    *capacidade = (uint32_t)novaCapacidade;
+    return nova;
+}
+
+static uint32_t tamBlocoNomes(uint32_t bloco) {
+    return bloco < BITS_POSICAO_NOME - 8 ? TAM_PRIMEIRO_BLOCO_NOMES << bloco : TAM_BLOCO_NOMES;
+}
+
+const char* nomeNoPool(const PoolNomes *pool, uint32_t deslocamento) {
+    return pool->blocos[deslocamento >> BITS_POSICAO_NOME] + (deslocamento & (TAM_BLOCO_NOMES - 1));
+}
+
+/**
+ * @brief Armazena o nome uma única vez no pool e devolve seu deslocamento.
+ * Nomes repetidos (o mesmo suspeito citado por várias pistas) compartilham o mesmo texto.
+ * Um nome nunca atravessa blocos: se não couber no último, começa um bloco novo.
+ */
+uint32_t internarNome(PoolNomes *pool, const char *nome) {
+    // Índice de endereçamento aberto com carga máxima de 1/2; guarda deslocamento + 1 (0 = vazio)
+    if (((uint64_t)pool->totalNomes + 1) * 2 > pool->capacidadeIndice) {
+        if (pool->capacidadeIndice > UINT32_MAX / 2) {
+            fprintf(stderr, "Erro: índice de nomes excedeu o limite de 32 bits.\n");
+            exit(EXIT_FAILURE);
+        }
+        uint32_t novaCapacidade = pool->capacidadeIndice > 0 ? pool->capacidadeIndice * 2 : 64;
+        uint32_t *novoIndice = (uint32_t*)calloc(novaCapacidade, sizeof(uint32_t));
+        if (novoIndice == NULL) {
+            perror("Erro ao ampliar índice de nomes");
+            exit(EXIT_FAILURE);
+        }
+        for (uint32_t i = 0; i < pool->capacidadeIndice; i++) {
+            if (pool->indice[i] == 0) continue;
+            uint32_t pos = (uint32_t)hashTexto(nomeNoPool(pool, pool->indice[i] - 1), 0) & (novaCapacidade - 1);
+            while (novoIndice[pos] != 0) pos = (pos + 1) & (novaCapacidade - 1);
+            novoIndice[pos] = pool->indice[i];
+        }
+        free(pool->indice);
+        pool->indice = novoIndice;
+        pool->capacidadeIndice = novaCapacidade;
+    }
+
+    uint32_t pos = (uint32_t)hashTexto(nome, 0) & (pool->capacidadeIndice - 1);
+    while (pool->indice[pos] != 0) {
+        if (strcmp(nomeNoPool(pool, pool->indice[pos] - 1), nome) == 0) {
+            return pool->indice[pos] - 1; // Já armazenado
+        }
+        pos = (pos + 1) & (pool->capacidadeIndice - 1);
+    }
+
+    size_t tam = strlen(nome) + 1;
+    if (tam > TAM_BLOCO_NOMES) {
+        fprintf(stderr, "Erro: nome maior que um bloco do pool de nomes.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (pool->totalBlocos == 0 || pool->usadoBloco + tam > tamBlocoNomes(pool->totalBlocos - 1)) {
+        if ((uint64_t)(pool->totalBlocos + 1) << BITS_POSICAO_NOME > LIMITE_POOL_NOMES) {
+            fprintf(stderr, "Erro: pool de nomes excedeu o limite de 31 bits.\n");
+            exit(EXIT_FAILURE);
+        }
+        if (pool->totalBlocos == pool->capacidadeBlocos) {
+            // Só a tabela de blocos é realocada; os blocos (e os nomes) ficam onde estão
+            uint32_t novaCapacidade = pool->capacidadeBlocos > 0 ? pool->capacidadeBlocos * 2 : 8;
+            char **novos = (char**)realloc(pool->blocos, sizeof(char*) * novaCapacidade);
+            if (novos == NULL) {
+                perror("Erro ao ampliar pool de nomes");
+                exit(EXIT_FAILURE);
+            }
+            pool->blocos = novos;
+            pool->capacidadeBlocos = novaCapacidade;
+        }
+        pool->blocos[pool->totalBlocos] = (char*)malloc(tamBlocoNomes(pool->totalBlocos));
+        if (pool->blocos[pool->totalBlocos] == NULL) {
+            perror("Erro ao ampliar pool de nomes");
+            exit(EXIT_FAILURE);
+        }
+        pool->totalBlocos++;
+        pool->usadoBloco = 0;
+    }
+
+    uint32_t deslocamento = ((pool->totalBlocos - 1) << BITS_POSICAO_NOME) | pool->usadoBloco;
+    memcpy(pool->blocos[pool->totalBlocos - 1] + pool->usadoBloco, nome, tam);
+    pool->usadoBloco += (uint32_t)tam;
+    pool->bytesNomes += tam;
+    pool->indice[pos] = deslocamento + 1;
+    pool->totalNomes++;
+    return deslocamento;
+}
+
+/**
+ * @brief Encerra um pool que não receberá mais nomes: libera o índice de deduplicação.
+ */
+void fecharPoolNomes(PoolNomes *pool) {
+    free(pool->indice);
+    pool->indice = NULL;
+    pool->capacidadeIndice = 0;
+}
+
+void liberarPoolNomes(PoolNomes *pool) {
+    for (uint32_t b = 0; b < pool->totalBlocos; b++) {
+        free(pool->blocos[b]);
+    }
+    free(pool->blocos);
+    free(pool->indice);
+    memset(pool, 0, sizeof(*pool));
+}
+
+// --- Arena de nós em blocos fixos (salas e pistas) ---
+
+static uint32_t nosNoBloco(uint32_t bloco) {
+    return bloco < BITS_POSICAO_NO - 4 ? NOS_PRIMEIRO_BLOCO << bloco : NOS_POR_BLOCO;
+}
+
+/**
+ * @brief Reserva um nó na arena. Só a tabela de blocos é realocada: nós já criados não se movem.
+ * @return Índice do novo nó (bloco << BITS_POSICAO_NO | posição).
+ */
+static IndiceNo novoNoArena(ArenaNos *arena) {
+    if (arena->totalBlocos == 0 || arena->usadosBloco == nosNoBloco(arena->totalBlocos - 1)) {
+        // O último bloco possível conteria INDICE_NULO, que é reservado
+        if (arena->totalBlocos >= (INDICE_NULO >> BITS_POSICAO_NO)) {
+            fprintf(stderr, "Erro: limite de índices de 32 bits atingido.\n");
+            exit(EXIT_FAILURE);
+        }
+        if (arena->totalBlocos == arena->capacidadeBlocos) {
+            uint32_t novaCapacidade = arena->capacidadeBlocos > 0 ? arena->capacidadeBlocos * 2 : 8;
+            char **blocos = (char**)realloc(arena->blocos, sizeof(char*) * novaCapacidade);
+            if (blocos != NULL) arena->blocos = blocos;
+            uint32_t *porEndereco = (uint32_t*)realloc(arena->porEndereco, sizeof(uint32_t) * novaCapacidade);
+            if (porEndereco != NULL) arena->porEndereco = porEndereco;
+            if (blocos == NULL || porEndereco == NULL) {
+                perror("Erro ao ampliar arena do modo compacto");
+                exit(EXIT_FAILURE);
+            }
+            arena->capacidadeBlocos = novaCapacidade;
+        }
+
+        uint32_t novo = arena->totalBlocos;
+        char *bloco = (char*)malloc(arena->tamNo * nosNoBloco(novo));
+        if (bloco == NULL) {
+            perror("Erro ao ampliar arena do modo compacto");
+            exit(EXIT_FAILURE);
+        }
+        // Mantém porEndereco ordenado (inserção: há poucos blocos, cada um com milhares de nós)
+        uint32_t i = novo;
+        while (i > 0 && (uintptr_t)arena->blocos[arena->porEndereco[i - 1]] > (uintptr_t)bloco) {
+            arena->porEndereco[i] = arena->porEndereco[i - 1];
+            i--;
+        }
+        arena->porEndereco[i] = novo;
+        arena->blocos[novo] = bloco;
+        arena->totalBlocos++;
+        arena->usadosBloco = 0;
+    }
+    arena->totalNos++;
+    return ((arena->totalBlocos - 1) << BITS_POSICAO_NO) | arena->usadosBloco++;
+}
+
+static void* noDaArena(const ArenaNos *arena, IndiceNo indice) {
+    if (indice == INDICE_NULO) return NULL;
+    return arena->blocos[indice >> BITS_POSICAO_NO] + (size_t)(indice & (NOS_POR_BLOCO - 1)) * arena->tamNo;
+}
+
+/**
+ * @brief Índice de um nó da arena a partir do seu endereço (busca binária nos blocos).
+ */
+static IndiceNo indiceNaArena(const ArenaNos *arena, const void *no) {
+    if (no == NULL || arena->totalBlocos == 0) return INDICE_NULO;
+    uintptr_t endereco = (uintptr_t)no;
+    uint32_t ini = 0;
+    uint32_t fim = arena->totalBlocos;
+    while (fim - ini > 1) { // Último bloco que começa em um endereço <= no
+        uint32_t meio = ini + (fim - ini) / 2;
+        if ((uintptr_t)arena->blocos[arena->porEndereco[meio]] <= endereco) ini = meio;
+        else fim = meio;
+    }
+    uint32_t bloco = arena->porEndereco[ini];
+    size_t posicao = (endereco - (uintptr_t)arena->blocos[bloco]) / arena->tamNo;
+    return (bloco << BITS_POSICAO_NO) | (uint32_t)posicao;
+}
+
+static void medirArena(const ArenaNos *arena, UsoMemoria *uso) {
+    uso->nos += arena->totalNos;
+    for (uint32_t b = 0; b < arena->totalBlocos; b++) {
+        uint32_t nos = (b + 1 < arena->totalBlocos) ? nosNoBloco(b) : arena->usadosBloco;
+        somarBloco(uso, arena->blocos[b], nos * arena->tamNo, nosNoBloco(b) * arena->tamNo);
+    }
+    somarBloco(uso, arena->blocos, 0, (size_t)arena->capacidadeBlocos * sizeof(char*));
+    somarBloco(uso, arena->porEndereco, 0, (size_t)arena->capacidadeBlocos * sizeof(uint32_t));
+}
+
+static void liberarArena(ArenaNos *arena) {
+    for (uint32_t b = 0; b < arena->totalBlocos; b++) {
+        free(arena->blocos[b]);
+    }
+    free(arena->blocos);
+    free(arena->porEndereco);
+    size_t tamNo = arena->tamNo;
+    memset(arena, 0, sizeof(*arena));
+    arena->tamNo = tamNo;
+}
+
+// --- Mapa e BST compactos ---
+// criarSala() e criarPistaNode() não recebem contexto: o mapa e a BST do caso vivem nestas
+// arenas, e os nomes de ambos no mesmo pool (a pista da sala e a da BST são o mesmo texto).
+static ArenaNos arenaSalas = { .tamNo = sizeof(Sala) };
+static ArenaNos arenaPistas = { .tamNo = sizeof(PistaNode) };
+static PoolNomes nomesCaso;
+
+/**
+ * @brief Interna um nome de sala ou pista truncado como nos char[50] do modo padrão.
+ */
+static uint32_t internarNomeDoCaso(const char *nome) {
+    char truncado[TAM_NOME_SALA];
+    snprintf(truncado, sizeof(truncado), "%s", nome);
+    return internarNome(&nomesCaso, truncado);
+}
+
+static void liberarNomesDoCasoSeVazio(void) {
+    if (arenaSalas.totalNos == 0 && arenaPistas.totalNos == 0) {
+        liberarPoolNomes(&nomesCaso);
+    }
+}
+
+/**
+ * @brief Cria uma sala (16 bytes) na arena do caso; ligue os filhos com ligarSalas().
+ */
+Sala* criarSala(const char *nome, int temPista, const char *pista) {
+    Sala *sala = (Sala*)noDaArena(&arenaSalas, novoNoArena(&arenaSalas));
+    sala->nome = internarNomeDoCaso(nome);
+    sala->pista = (temPista && pista != NULL) ? (internarNomeDoCaso(pista) | SALA_TEM_PISTA) : 0;
+    sala->esquerda = INDICE_NULO;
+    sala->direita = INDICE_NULO;
+    return sala;
+}
+
+void ligarSalas(Sala *sala, Sala *esquerda, Sala *direita) {
+    sala->esquerda = indiceNaArena(&arenaSalas, esquerda);
+    sala->direita = indiceNaArena(&arenaSalas, direita);
+}
+
+const char* nomeSala(const Sala *sala) {
+    return nomeNoPool(&nomesCaso, sala->nome);
+}
+
+int salaTemPista(const Sala *sala) {
+    return (sala->pista & SALA_TEM_PISTA) != 0;
+}
+
+const char* pistaDaSala(const Sala *sala) {
+    return salaTemPista(sala) ? nomeNoPool(&nomesCaso, sala->pista & ~SALA_TEM_PISTA) : "";
+}
+
+Sala* salaEsquerda(const Sala *sala) {
+    return (Sala*)noDaArena(&arenaSalas, sala->esquerda);
+}
+
+Sala* salaDireita(const Sala *sala) {
+    return (Sala*)noDaArena(&arenaSalas, sala->direita);
+}
+
+/**
+ * @brief Libera o mapa. Todas as salas do caso estão na mesma arena, que é liberada inteira.
+ */
+void liberarMapa(Sala *raiz) {
+    if (raiz == NULL) return;
+    liberarArena(&arenaSalas);
+    liberarNomesDoCasoSeVazio();
+}
+
+static IndiceNo novaPistaNode(const char *nome) {
+    IndiceNo indice = novoNoArena(&arenaPistas);
+    PistaNode *no = (PistaNode*)noDaArena(&arenaPistas, indice);
+    no->nome = internarNomeDoCaso(nome);
+    no->esquerda = INDICE_NULO;
+    no->direita = INDICE_NULO;
+    return indice;
+}
+
+PistaNode* criarPistaNode(const char *nome) {
+    return (PistaNode*)noDaArena(&arenaPistas, novaPistaNode(nome));
+}
+
+/**
+ * @brief Insere uma pista na BST compacta (ordem de strcmp); pistas repetidas são ignoradas.
+ * @return A raiz da BST (nova apenas se a árvore estava vazia).
+ */
+PistaNode* inserirPista(PistaNode *raiz, const char *nome) {
+    if (raiz == NULL) {
+        return criarPistaNode(nome);
+    }
+    char truncado[TAM_NOME_PISTA];
+    snprintf(truncado, sizeof(truncado), "%s", nome);
+
+    PistaNode *atual = raiz;
+    for (;;) {
+        int cmp = strcmp(truncado, nomeNoPool(&nomesCaso, atual->nome));
+        if (cmp == 0) {
+            return raiz; // Pista já coletada
+        }
+        IndiceNo filho = cmp < 0 ? atual->esquerda : atual->direita;
+        if (filho == INDICE_NULO) {
+            // atual continua válido: os blocos da arena não se movem
+            IndiceNo novo = novaPistaNode(truncado);
+            if (cmp < 0) atual->esquerda = novo;
+            else atual->direita = novo;
+            return raiz;
+        }
+        atual = (PistaNode*)noDaArena(&arenaPistas, filho);
+    }
+}
+
+PistaNode* buscarPista(PistaNode *raiz, const char *nome) {
+    PistaNode *atual = raiz;
+    while (atual != NULL) {
+        int cmp = strcmp(nome, nomeNoPool(&nomesCaso, atual->nome));
+        if (cmp == 0) return atual;
+        atual = (PistaNode*)noDaArena(&arenaPistas, cmp < 0 ? atual->esquerda : atual->direita);
+    }
+    return NULL;
+}
+
+const char* nomePistaNode(const PistaNode *no) {
+    return nomeNoPool(&nomesCaso, no->nome);
+}
+
+PistaNode* pistaEsquerda(const PistaNode *no) {
+    return (PistaNode*)noDaArena(&arenaPistas, no->esquerda);
+}
+
+PistaNode* pistaDireita(const PistaNode *no) {
+    return (PistaNode*)noDaArena(&arenaPistas, no->direita);
+}
+
+/**
+ * @brief Libera a BST. Todas as pistas coletadas estão na mesma arena, que é liberada inteira.
+ */
+void liberarPistas(PistaNode *raiz) {
+    if (raiz == NULL) return;
+    liberarArena(&arenaPistas);
+    liberarNomesDoCasoSeVazio();
+}
+
+/**
+ * @brief Soma ao relatório as arenas de salas e pistas e o pool de nomes do caso.
+ */
+void contabilizarCasoCompacto(RelatorioMemoria *relatorio) {
+    medirArena(&arenaSalas, &relatorio->salas);
+    medirArena(&arenaPistas, &relatorio->pistas);
+    medirPoolNomes(&nomesCaso, &relatorio->nomes);
+}
+
+// --- Tabela Hash compacta ---
+
+void inicializarHash(TabelaHash hash) {
+    memset(hash, 0, sizeof(TabelaHash));
+    for (int i = 0; i < TAM_TABELA_HASH; i++) {
+        hash->baldes[i] = INDICE_NULO;
+    }
+}
+
+/**
+ * @brief Insere o par (pista, suspeito) no início da lista do balde, como no modo padrão.
+ * Os nomes são truncados no mesmo tamanho dos char[50] do modo padrão.
+ */
+void inserirNaHash(TabelaHash hash, const char *pista, const char *suspeito) {
+    char nomePista[TAM_NOME_PISTA];
+    char nomeSuspeito[TAM_NOME_SUSPEITO];
+    strncpy(nomePista, pista, TAM_NOME_PISTA - 1);
+    nomePista[TAM_NOME_PISTA - 1] = '\0';
+    strncpy(nomeSuspeito, suspeito, TAM_NOME_SUSPEITO - 1);
+    nomeSuspeito[TAM_NOME_SUSPEITO - 1] = '\0';
+
+    int indice = funcaoHash(nomePista);
+    hash->nos = (HashNode*)reservarNaArena(hash->nos, hash->totalNos, &hash->capacidadeNos, sizeof(HashNode));
+    HashNode *novo = &hash->nos[hash->totalNos];
+    novo->pista = internarNome(&hash->nomes, nomePista);
+    novo->suspeito = internarNome(&hash->nomes, nomeSuspeito);
+    novo->proximo = hash->baldes[indice];
+    hash->baldes[indice] = hash->totalNos++;
+}
+
+const char* buscarSuspeito(TabelaHash hash, const char *pista) {
+    for (IndiceNo i = hash->baldes[funcaoHash(pista)]; i != INDICE_NULO; i = hash->nos[i].proximo) {
+        if (strcasecmp(nomeNoPool(&hash->nomes, hash->nos[i].pista), pista) == 0) {
+            return nomeNoPool(&hash->nomes, hash->nos[i].suspeito);
+        }
+    }
+    return NULL;
+}
+
+void liberarHash(TabelaHash hash) {
+    free(hash->nos);
+    liberarPoolNomes(&hash->nomes);
+    inicializarHash(hash);
+}
+
+CursorHash inicioListaHash(TabelaHash hash, int balde) {
+    return hash->baldes[balde];
+}
+
+CursorHash proximoNaListaHash(TabelaHash hash, CursorHash no) {
+    return hash->nos[no].proximo;
+}
+
+const char* pistaNoHash(TabelaHash hash, CursorHash no) {
+    return nomeNoPool(&hash->nomes, hash->nos[no].pista);
+}
+
+const char* suspeitoNoHash(TabelaHash hash, CursorHash no) {
+    return nomeNoPool(&hash->nomes, hash->nos[no].suspeito);
+}
+#endif // MODO_COMPACTO
+
 // ============================================================================
 // --- Implementação das Funções do Mapa (Árvore Binária) ---
 // ============================================================================